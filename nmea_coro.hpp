@@ -0,0 +1,391 @@
+// C++20 coroutine pipeline around nmea_parser
+//
+// byte source -> frames -> checked -> decoded -> epochs
+//
+// Every stage is a lazy async_generator: nothing is read until the consumer
+// asks for the next item, so a slow consumer never lets bytes pile up. Each
+// stage allocates its coroutine frame once, sentences are handed down the
+// pipeline by reference to the frame's own nmeaBuffer_t / navData_t.
+//
+// navData_t nav;               // set up like for nmea_parse
+// nmea::buffer_source source(data, size);
+// auto epochs = nmea::epochs(source, nav);
+// while (navData_t *epoch = co_await epochs.next()) {
+//   // do something with the data
+// }
+//
+// A byte source provides `read(char *data, std::size_t size)` returning an
+// awaitable std::ptrdiff_t: bytes read, 0 at the end of the stream or -1 when
+// it should be retried. fd_source suspends on a would-block read and hands the
+// coroutine to a reactor, anything with `wait_readable(int fd,
+// std::coroutine_handle<>)` will do, poll_reactor is a minimal one.
+#ifndef NMEA_CORO_HPP
+#define NMEA_CORO_HPP
+
+#include <cerrno>
+#include <coroutine>
+#include <cstddef>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <poll.h>
+#include <unistd.h>
+
+#include "nmea_parser.h"
+
+#ifndef NMEA_CORO_CHUNK_SIZE
+#define NMEA_CORO_CHUNK_SIZE 512 // bytes requested from the source at once
+#endif
+
+namespace nmea {
+
+// Lazy generator whose body may co_await, items are yielded by reference
+// and stay valid until the next call to next().
+//
+// next() resumes the producer as a plain call, so the stack only grows with
+// the depth of the pipeline and not with the number of items. Only when the
+// producer suspends on its source does the consumer stay suspended, the next
+// co_yield then transfers straight back to it.
+template <class T> class async_generator {
+public:
+  struct promise_type;
+  using handle_type = std::coroutine_handle<promise_type>;
+
+  enum class resume_state { idle, inline_resume, suspended };
+
+  struct yield_awaiter {
+    bool await_ready() noexcept { return false; }
+    std::coroutine_handle<> await_suspend(handle_type h) noexcept {
+      promise_type &p = h.promise();
+      if (std::exchange(p.state, resume_state::idle) ==
+          resume_state::inline_resume)
+        return std::noop_coroutine(); // back into next()
+      return p.consumer;
+    }
+    void await_resume() noexcept {}
+  };
+
+  struct promise_type {
+    T *value = nullptr;
+    std::coroutine_handle<> consumer;
+    std::exception_ptr error;
+    resume_state state = resume_state::idle;
+
+    async_generator get_return_object() {
+      return async_generator{handle_type::from_promise(*this)};
+    }
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    yield_awaiter final_suspend() noexcept { return {}; }
+    yield_awaiter yield_value(T &item) noexcept {
+      value = std::addressof(item);
+      return {};
+    }
+    void return_void() noexcept { value = nullptr; }
+    void unhandled_exception() noexcept {
+      error = std::current_exception();
+      value = nullptr;
+    }
+  };
+
+  async_generator(async_generator &&other) noexcept
+      : handle_(std::exchange(other.handle_, nullptr)) {}
+  async_generator &operator=(async_generator &&other) noexcept {
+    if (this != &other) {
+      if (handle_)
+        handle_.destroy();
+      handle_ = std::exchange(other.handle_, nullptr);
+    }
+    return *this;
+  }
+  ~async_generator() {
+    if (handle_)
+      handle_.destroy();
+  }
+
+  // co_await gen.next() gives the next item or nullptr at the end
+  auto next() noexcept {
+    struct awaiter {
+      handle_type h;
+      bool await_ready() noexcept { return !h || h.done(); }
+      bool await_suspend(std::coroutine_handle<> c) {
+        promise_type &p = h.promise();
+        p.consumer = c;
+        p.state = resume_state::inline_resume;
+        h.resume();
+        if (p.state == resume_state::inline_resume) {
+          // waiting on the source, co_yield resumes the consumer later
+          p.state = resume_state::suspended;
+          return true;
+        }
+        return false;
+      }
+      T *await_resume() {
+        if (!h)
+          return nullptr;
+        if (h.promise().error)
+          std::rethrow_exception(std::exchange(h.promise().error, nullptr));
+        return h.done() ? nullptr : h.promise().value;
+      }
+    };
+    return awaiter{handle_};
+  }
+
+private:
+  explicit async_generator(handle_type h) : handle_(h) {}
+  handle_type handle_;
+};
+
+// Top level coroutine driving a pipeline. Starts on start(), runs until it
+// suspends on a source, then the reactor resumes it.
+class task {
+public:
+  struct promise_type {
+    std::exception_ptr error;
+
+    task get_return_object() {
+      return task{std::coroutine_handle<promise_type>::from_promise(*this)};
+    }
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    std::suspend_always final_suspend() noexcept { return {}; }
+    void return_void() noexcept {}
+    void unhandled_exception() noexcept { error = std::current_exception(); }
+  };
+
+  task(task &&other) noexcept
+      : handle_(std::exchange(other.handle_, nullptr)) {}
+  task &operator=(task &&) = delete;
+  ~task() {
+    if (handle_)
+      handle_.destroy();
+  }
+
+  void start() { handle_.resume(); }
+  bool done() const { return handle_.done(); }
+  // rethrows whatever ended the coroutine
+  void get() {
+    if (handle_.promise().error)
+      std::rethrow_exception(handle_.promise().error);
+  }
+
+private:
+  explicit task(std::coroutine_handle<promise_type> h) : handle_(h) {}
+  std::coroutine_handle<promise_type> handle_;
+};
+
+// Single threaded poll() loop resuming coroutines waiting on readable fds
+class poll_reactor {
+public:
+  void wait_readable(int fd, std::coroutine_handle<> h) {
+    waiters_.push_back({fd, h});
+  }
+
+  // returns once nothing is waiting any more
+  void run() {
+    while (!waiters_.empty()) {
+      fds_.clear();
+      for (const waiter &w : waiters_)
+        fds_.push_back({w.fd, POLLIN, 0});
+      if (::poll(fds_.data(), fds_.size(), -1) < 0) {
+        if (errno == EINTR)
+          continue;
+        throw std::system_error(errno, std::generic_category(), "poll");
+      }
+      // resuming may register new waiters, so collect the ready ones first
+      ready_.clear();
+      std::size_t keep = 0;
+      for (std::size_t i = 0; i < fds_.size(); i++) {
+        if (fds_[i].revents)
+          ready_.push_back(waiters_[i].h);
+        else
+          waiters_[keep++] = waiters_[i];
+      }
+      waiters_.resize(keep);
+      for (std::coroutine_handle<> h : ready_)
+        h.resume();
+    }
+  }
+
+private:
+  struct waiter {
+    int fd;
+    std::coroutine_handle<> h;
+  };
+  std::vector<waiter> waiters_;
+  std::vector<pollfd> fds_;
+  std::vector<std::coroutine_handle<>> ready_;
+};
+
+// Bytes from memory, never suspends. `chunk` limits a single read to mimic
+// partial reads.
+class buffer_source {
+public:
+  buffer_source(const char *data, std::size_t size,
+                std::size_t chunk = static_cast<std::size_t>(-1))
+      : data_(data), size_(size), chunk_(chunk) {}
+
+  auto read(char *data, std::size_t size) {
+    struct awaiter {
+      std::ptrdiff_t n;
+      bool await_ready() noexcept { return true; }
+      void await_suspend(std::coroutine_handle<>) noexcept {}
+      std::ptrdiff_t await_resume() noexcept { return n; }
+    };
+    std::size_t n = size_ < size ? size_ : size;
+    n = n < chunk_ ? n : chunk_;
+    std::memcpy(data, data_, n);
+    data_ += n;
+    size_ -= n;
+    return awaiter{static_cast<std::ptrdiff_t>(n)};
+  }
+
+private:
+  const char *data_;
+  std::size_t size_;
+  std::size_t chunk_;
+};
+
+// Bytes from a non-blocking fd (serial port, pipe, socket). A read that would
+// block suspends until the reactor sees the fd readable.
+template <class Reactor> class fd_source {
+public:
+  fd_source(int fd, Reactor &reactor) : fd_(fd), reactor_(reactor) {}
+
+  auto read(char *data, std::size_t size) {
+    struct awaiter {
+      fd_source &source;
+      char *data;
+      std::size_t size;
+      ::ssize_t n = -1;
+      int error = 0;
+
+      bool await_ready() {
+        n = ::read(source.fd_, data, size);
+        error = n < 0 ? errno : 0;
+        return n >= 0 || !would_block();
+      }
+      void await_suspend(std::coroutine_handle<> h) {
+        source.reactor_.wait_readable(source.fd_, h);
+      }
+      std::ptrdiff_t await_resume() {
+        if (n < 0 && !would_block())
+          throw std::system_error(error, std::generic_category(), "read");
+        return n; // -1 after a wakeup, the caller reads again
+      }
+      bool would_block() const {
+        return error == EAGAIN || error == EWOULDBLOCK || error == EINTR;
+      }
+    };
+    return awaiter{*this, data, size};
+  }
+
+private:
+  int fd_;
+  Reactor &reactor_;
+};
+
+// Moves the sentence after the last '$' of the line to the front
+inline void resync(nmeaBuffer_t &line, std::size_t length) {
+  const char *start = line.str;
+  while (const char *next = static_cast<const char *>(
+             std::memchr(start + 1, '$', length - (start + 1 - line.str))))
+    start = next;
+  if (start != line.str)
+    std::memmove(line.str, start, length - (start - line.str) + 1);
+}
+
+// Splits the byte stream into sentences from '$' to '\n'. Garbage before '$'
+// and sentences longer than NMEA_BUFFER_SIZE are dropped, a '$' inside a line
+// restarts the sentence. PUBX,03 with more satellites than the buffer holds is
+// dropped as a whole, see NMEA_PUBX03_ENABLED in nmea_parser.h.
+template <class Source> async_generator<nmeaBuffer_t> frames(Source &source) {
+  nmeaBuffer_t line;
+  char chunk[NMEA_CORO_CHUNK_SIZE];
+  std::size_t length = 0;
+  bool in_sentence = false;
+
+  for (;;) {
+    std::ptrdiff_t n = co_await source.read(chunk, sizeof(chunk));
+    if (n < 0)
+      continue;
+    if (n == 0)
+      break;
+    const char *c = chunk;
+    const char *end = chunk + n;
+    while (c < end) {
+      if (!in_sentence) {
+        c = static_cast<const char *>(std::memchr(c, '$', end - c));
+        if (!c)
+          break;
+        in_sentence = true;
+        length = 0;
+      }
+      const char *eol =
+          static_cast<const char *>(std::memchr(c, '\n', end - c));
+      const char *stop = eol ? eol : end;
+      std::size_t span = stop - c;
+      if (length + span < sizeof(line.str)) {
+        std::memcpy(line.str + length, c, span);
+        length += span;
+      } else {
+        in_sentence = false;
+      }
+      c = stop;
+      if (eol && in_sentence) {
+        c++;
+        in_sentence = false;
+        if (line.str[length - 1] == '\r')
+          length--;
+        line.str[length] = '\0';
+        resync(line, length);
+        co_yield line;
+      }
+    }
+  }
+  // last sentence without a line end
+  if (in_sentence) {
+    line.str[length] = '\0';
+    resync(line, length);
+    co_yield line;
+  }
+}
+
+// Drops sentences whose checksum does not match, see nmea_verify
+inline async_generator<nmeaBuffer_t>
+checked(async_generator<nmeaBuffer_t> frames) {
+  while (nmeaBuffer_t *line = co_await frames.next()) {
+    if (nmea_verify(line) == 0)
+      co_yield *line;
+  }
+}
+
+// Feeds sentences to nmea_parse, yields navData after every parsed one
+inline async_generator<navData_t>
+decoded(async_generator<nmeaBuffer_t> sentences, navData_t &navData) {
+  while (nmeaBuffer_t *line = co_await sentences.next()) {
+    if (nmea_parse(line, &navData) == 0)
+      co_yield navData;
+  }
+}
+
+// Yields navData once every enabled sentence of the cycle has been parsed
+inline async_generator<navData_t>
+epochs(async_generator<navData_t> decoded) {
+  while (navData_t *navData = co_await decoded.next()) {
+    if (navData->cycle == navData->cycles_max)
+      co_yield *navData;
+  }
+}
+
+// The whole pipeline, source -> completed epochs
+template <class Source>
+async_generator<navData_t> epochs(Source &source, navData_t &navData) {
+  return epochs(decoded(checked(frames(source)), navData));
+}
+
+} // namespace nmea
+
+#endif // NMEA_CORO_HPP
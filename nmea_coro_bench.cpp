@@ -0,0 +1,229 @@
+// Throughput of the coroutine pipeline (nmea_coro.hpp) against a hand written
+// read loop around nmea_verify / nmea_parse on the same sentence stream.
+//
+// nmea_coro_bench [epochs]
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "nmea_coro.hpp"
+
+#ifndef NMEA_BENCH_WRAP_MALLOC
+#define NMEA_BENCH_WRAP_MALLOC 0
+#endif
+
+// Heap allocations, to show the pipeline does not allocate per sentence. With
+// NMEA_BENCH_WRAP_MALLOC the linker routes malloc here (--wrap=malloc), which
+// also catches the parser's own mallocs, otherwise only operator new counts.
+static std::size_t allocations = 0;
+
+#if NMEA_BENCH_WRAP_MALLOC
+extern "C" void *__real_malloc(std::size_t size);
+extern "C" void *__wrap_malloc(std::size_t size) {
+  allocations++;
+  return __real_malloc(size);
+}
+#endif
+
+void *operator new(std::size_t size) {
+#if !NMEA_BENCH_WRAP_MALLOC
+  allocations++;
+#endif
+  if (void *p = std::malloc(size ? size : 1))
+    return p;
+  throw std::bad_alloc();
+}
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+
+static void append_sentence(std::string &stream, const char *body) {
+  unsigned char checksum = 0;
+  for (const char *c = body; *c; c++)
+    checksum ^= (unsigned char)*c;
+  char tail[8];
+  std::snprintf(tail, sizeof(tail), "*%02X\r\n", checksum);
+  stream += '$';
+  stream += body;
+  stream += tail;
+}
+
+// One epoch per second of RMC, GGA, GSA, 3x GSV, GLL and VTG
+static std::string make_stream(unsigned epochs, unsigned &sentences) {
+  std::string stream;
+  char body[128];
+  for (unsigned i = 0; i < epochs; i++) {
+    unsigned t = 120000 + i % 4000;
+    std::snprintf(body, sizeof(body),
+                  "GPRMC,%06u.00,A,4936.86732,N,01907.19394,E,0.117,,010624,"
+                  ",,A",
+                  t);
+    append_sentence(stream, body);
+    std::snprintf(body, sizeof(body),
+                  "GPGGA,%06u.00,4936.86732,N,01907.19394,E,1,08,1.01,260.4,M,"
+                  "40.4,M,,",
+                  t);
+    append_sentence(stream, body);
+    append_sentence(stream,
+                    "GPGSA,A,3,05,13,15,18,20,23,24,29,,,,,1.91,1.01,1.62");
+    append_sentence(stream, "GPGSV,3,1,10,05,23,300,34,13,31,219,29,15,61,"
+                            "187,31,18,37,092,32");
+    append_sentence(stream, "GPGSV,3,2,10,20,36,283,33,23,28,146,36,24,77,"
+                            "279,32,25,02,058,");
+    append_sentence(stream, "GPGSV,3,3,10,29,38,055,35,30,05,318,");
+    std::snprintf(body, sizeof(body),
+                  "GPGLL,4936.86732,N,01907.19394,E,%06u.00,A,A", t);
+    append_sentence(stream, body);
+    append_sentence(stream, "GPVTG,,T,,M,0.117,N,0.217,K,A");
+    sentences += 8;
+  }
+  return stream;
+}
+
+struct nav_storage {
+  xxRMC_t rmc{};
+  xxGGA_t gga{};
+  xxVTG_t vtg{};
+  xxGSA_t gsa{};
+  xxGSV_t gsv{};
+  xxGLL_t gll{};
+  navData_t nav;
+
+  nav_storage() {
+    nmea_nullify(&nav);
+    nav.rmc = &rmc;
+    nav.gga = &gga;
+    nav.vtg = &vtg;
+    nav.gsa = &gsa;
+    nav.gsv = &gsv;
+    nav.gll = &gll;
+    nmea_init(&nav, "GP", "RMC");
+  }
+  ~nav_storage() { nmea_free(&nav); }
+};
+
+// The loop every user used to write by hand
+static unsigned run_sync(const std::string &stream) {
+  nav_storage storage;
+  nmeaBuffer_t line;
+  unsigned epochs = 0;
+  const char *c = stream.data();
+  const char *end = c + stream.size();
+  while (c < end) {
+    const char *eol = static_cast<const char *>(std::memchr(c, '\n', end - c));
+    if (!eol)
+      eol = end;
+    std::size_t length = eol - c;
+    if (length && c[length - 1] == '\r')
+      length--;
+    if (length < sizeof(line.str)) {
+      std::memcpy(line.str, c, length);
+      line.str[length] = '\0';
+      if (nmea_verify(&line) == 0 && nmea_parse(&line, &storage.nav) == 0 &&
+          storage.nav.cycle == storage.nav.cycles_max)
+        epochs++;
+    }
+    c = eol + 1;
+  }
+  return epochs;
+}
+
+template <class Source>
+static nmea::task consume(Source &source, navData_t &nav, unsigned &epochs) {
+  auto pipeline = nmea::epochs(source, nav);
+  while (co_await pipeline.next())
+    epochs++;
+}
+
+static unsigned run_coro(const std::string &stream) {
+  nav_storage storage;
+  nmea::buffer_source source(stream.data(), stream.size());
+  unsigned epochs = 0;
+  nmea::task t = consume(source, storage.nav, epochs);
+  t.start();
+  t.get();
+  return epochs;
+}
+
+// A child process writes the stream into a pipe, the pipeline reads the
+// non-blocking end from a poll_reactor
+static unsigned run_pipe(const std::string &stream) {
+  int fds[2];
+  if (pipe(fds)) {
+    std::perror("pipe");
+    std::exit(EXIT_FAILURE);
+  }
+  pid_t child = fork();
+  if (child == 0) {
+    close(fds[0]);
+    for (std::size_t done = 0; done < stream.size();) {
+      ssize_t n = write(fds[1], stream.data() + done, stream.size() - done);
+      if (n < 0)
+        _exit(EXIT_FAILURE);
+      done += n;
+    }
+    _exit(EXIT_SUCCESS);
+  }
+  close(fds[1]);
+  fcntl(fds[0], F_SETFL, fcntl(fds[0], F_GETFL) | O_NONBLOCK);
+
+  nav_storage storage;
+  nmea::poll_reactor reactor;
+  nmea::fd_source<nmea::poll_reactor> source(fds[0], reactor);
+  unsigned epochs = 0;
+  nmea::task t = consume(source, storage.nav, epochs);
+  t.start();
+  reactor.run();
+  t.get();
+  close(fds[0]);
+  waitpid(child, nullptr, 0);
+  return epochs;
+}
+
+struct runner {
+  const char *name;
+  unsigned (*run)(const std::string &stream);
+  double best;
+  unsigned epochs;
+  std::size_t allocated;
+};
+
+int main(int argc, char **argv) {
+  unsigned epochs = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 100000;
+  unsigned sentences = 0;
+  std::string stream = make_stream(epochs, sentences);
+  std::printf("%u epochs, %u sentences, %zu bytes\n", epochs, sentences,
+              stream.size());
+
+  runner runners[] = {{"sync", run_sync, 0, 0, 0},
+                      {"coroutine", run_coro, 0, 0, 0},
+                      {"pipe", run_pipe, 0, 0, 0}};
+  // Rounds interleave the runners so they share the same machine noise,
+  // the best round counts
+  for (int round = 0; round < 5; round++) {
+    for (runner &r : runners) {
+      std::size_t before = allocations;
+      auto start = std::chrono::steady_clock::now();
+      r.epochs = r.run(stream);
+      std::chrono::duration<double> elapsed =
+          std::chrono::steady_clock::now() - start;
+      r.allocated = allocations - before;
+      if (round == 0 || elapsed.count() < r.best)
+        r.best = elapsed.count();
+    }
+  }
+  for (const runner &r : runners) {
+    std::printf("%-10s %8.1f ms %8.2f M sentences/s %6.1f MB/s  epochs %u  "
+                "%s %zu\n",
+                r.name, r.best * 1e3, sentences / r.best / 1e6,
+                stream.size() / r.best / 1e6, r.epochs,
+                NMEA_BENCH_WRAP_MALLOC ? "malloc" : "operator new", r.allocated);
+  }
+  return 0;
+}
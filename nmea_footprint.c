@@ -0,0 +1,47 @@
+// Static footprint of the parser for the NMEA_*_ENABLED switches it is
+// compiled with. Only compiled, never linked or run: every nmea_sizeof_<type>
+// object is as large as <type>, so `nm -S` on the object file reads the sizes
+// of the target ABI. Used by the nmea_footprint target, see
+// nmea_footprint.cmake.
+#include "nmea_parser.h"
+
+#define NMEA_SIZEOF(type) const char nmea_sizeof_##type[sizeof(type)] = {0}
+
+NMEA_SIZEOF(nmeaBuffer_t);
+NMEA_SIZEOF(navData_t);
+#if NMEA_RMC_ENABLED
+NMEA_SIZEOF(xxRMC_t);
+#endif
+#if NMEA_GGA_ENABLED
+NMEA_SIZEOF(xxGGA_t);
+#endif
+#if NMEA_VTG_ENABLED
+NMEA_SIZEOF(xxVTG_t);
+#endif
+#if NMEA_GSA_ENABLED
+NMEA_SIZEOF(xxGSA_t);
+#endif
+#if NMEA_GSV_ENABLED
+NMEA_SIZEOF(xxGSV_t);
+#endif
+#if NMEA_GLL_ENABLED
+NMEA_SIZEOF(xxGLL_t);
+#endif
+#if NMEA_GNS_ENABLED
+NMEA_SIZEOF(xxGNS_t);
+#endif
+#if NMEA_GST_ENABLED
+NMEA_SIZEOF(xxGST_t);
+#endif
+#if NMEA_ZDA_ENABLED
+NMEA_SIZEOF(xxZDA_t);
+#endif
+#if NMEA_PUBX00_ENABLED
+NMEA_SIZEOF(PUBX00_t);
+#endif
+#if NMEA_PUBX03_ENABLED
+NMEA_SIZEOF(PUBX03_t);
+#endif
+#if NMEA_PUBX04_ENABLED
+NMEA_SIZEOF(PUBX04_t);
+#endif
@@ -0,0 +1,174 @@
+# Reports sizeof and parser stack of nmea_parser for every combination of
+# the NMEA_*_ENABLED switches. Run through the nmea_footprint target:
+#   cmake --build build --target nmea_footprint
+#
+# Expects NMEA_CC, NMEA_NM, NMEA_SOURCE_DIR, NMEA_WORK_DIR and NMEA_FOOTPRINT,
+# optionally NMEA_FLAGS (the target compile flags, -Os when empty)
+# and NMEA_SENTENCES, the comma separated switches to combine (defaults to
+# RMC,GGA,VTG,GSA,GSV,GLL, the rest is disabled). Nothing is linked or run, so
+# a cross compiler works: sizes are read with NMEA_NM from the objects
+# nmea_footprint.c defines, stack usage comes from -fstack-usage and follows
+# nmea_parse -> (nmea_parse_pubx ->) preprocess_nmea / populate_* -> clear_*.
+# libc calls (sscanf, strtoul, ...) are not included, their frames come on top.
+
+cmake_policy(VERSION 3.10)
+
+set(all_sentences RMC GGA VTG GSA GSV GLL GNS GST ZDA PUBX00 PUBX03 PUBX04)
+set(sentences RMC GGA VTG GSA GSV GLL)
+if(NMEA_SENTENCES)
+  string(REPLACE "," ";" sentences "${NMEA_SENTENCES}")
+endif()
+list(LENGTH sentences count)
+math(EXPR last "${count} - 1")
+math(EXPR masks "(1 << ${count}) - 1")
+string(REPLACE ";" "," label "${sentences}")
+string(LENGTH "${label}" label_width)
+if(label_width LESS 17)
+  set(label_width 17) # "enabled sentences"
+endif()
+if(NOT NMEA_FLAGS)
+  set(NMEA_FLAGS -Os)
+endif()
+separate_arguments(NMEA_FLAGS)
+file(MAKE_DIRECTORY ${NMEA_WORK_DIR})
+
+# Stack of function `func` as read from the .su file, 0 if it is not there
+macro(nmea_stack func out)
+  set(${out} 0)
+  foreach(line IN LISTS su_lines)
+    if(line MATCHES ":${func}\t([0-9]+)\t")
+      set(${out} ${CMAKE_MATCH_1})
+    endif()
+  endforeach()
+endmacro()
+
+# Pads `text` with spaces to `width` columns, on the left when `right` is set
+function(nmea_pad text width right out)
+  string(LENGTH "${text}" length)
+  while(length LESS width)
+    if(right)
+      set(text " ${text}")
+    else()
+      set(text "${text} ")
+    endif()
+    math(EXPR length "${length} + 1")
+  endwhile()
+  set(${out} "${text}" PARENT_SCOPE)
+endfunction()
+
+set(report "footprint profile: NMEA_FOOTPRINT=${NMEA_FOOTPRINT}\n")
+string(APPEND report "sizes in bytes, stack of the parser excluding libc ")
+string(APPEND report "calls (sscanf, strtoul, ...)\n\n")
+nmea_pad("enabled sentences" ${label_width} FALSE row)
+string(APPEND report "${row} buffer navData structs  total  stack excl. libc\n")
+
+foreach(mask RANGE 1 ${masks})
+  set(defs -DNMEA_FOOTPRINT=${NMEA_FOOTPRINT})
+  set(enabled)
+  foreach(i RANGE 0 ${last})
+    list(GET sentences ${i} sentence)
+    math(EXPR bit "(${mask} >> ${i}) & 1")
+    if(bit)
+      list(APPEND enabled ${sentence})
+    endif()
+  endforeach()
+  foreach(sentence IN LISTS all_sentences)
+    list(FIND enabled ${sentence} bit)
+    if(bit EQUAL -1)
+      list(APPEND defs -DNMEA_${sentence}_ENABLED=0)
+    else()
+      list(APPEND defs -DNMEA_${sentence}_ENABLED=1)
+    endif()
+  endforeach()
+
+  execute_process(
+    COMMAND ${NMEA_CC} ${NMEA_FLAGS} ${defs} -fstack-usage
+            -c ${NMEA_SOURCE_DIR}/nmea_parser.c -o nmea_parser.o
+    WORKING_DIRECTORY ${NMEA_WORK_DIR}
+    RESULT_VARIABLE result)
+  if(result)
+    message(FATAL_ERROR "nmea_parser.c failed to compile with ${defs}")
+  endif()
+  execute_process(
+    COMMAND ${NMEA_CC} ${NMEA_FLAGS} ${defs} -I${NMEA_SOURCE_DIR}
+            -c ${NMEA_SOURCE_DIR}/nmea_footprint.c -o nmea_footprint.o
+    WORKING_DIRECTORY ${NMEA_WORK_DIR}
+    RESULT_VARIABLE result)
+  if(result)
+    message(FATAL_ERROR "nmea_footprint.c failed to compile with ${defs}")
+  endif()
+  execute_process(
+    COMMAND ${NMEA_NM} -S -t d nmea_footprint.o
+    WORKING_DIRECTORY ${NMEA_WORK_DIR}
+    OUTPUT_VARIABLE symbols
+    RESULT_VARIABLE result)
+  if(result)
+    message(FATAL_ERROR "${NMEA_NM} failed on nmea_footprint.o")
+  endif()
+
+  # "<address> <size> <type> nmea_sizeof_<type>", with a leading _ on some ABIs
+  set(buffer 0)
+  set(nav 0)
+  set(structs 0)
+  string(REPLACE "\n" ";" symbols "${symbols}")
+  foreach(line IN LISTS symbols)
+    if(line MATCHES "^[0-9]+ 0*([0-9]+) . _?nmea_sizeof_(.+)$")
+      set(size ${CMAKE_MATCH_1})
+      if(CMAKE_MATCH_2 STREQUAL "nmeaBuffer_t")
+        set(buffer ${size})
+      elseif(CMAKE_MATCH_2 STREQUAL "navData_t")
+        set(nav ${size})
+      else()
+        math(EXPR structs "${structs} + ${size}")
+      endif()
+    endif()
+  endforeach()
+  if(NOT buffer OR NOT nav)
+    message(FATAL_ERROR "no nmea_sizeof_* symbols in the output of ${NMEA_NM}")
+  endif()
+  math(EXPR total "${buffer} + ${nav} + ${structs}")
+
+  file(STRINGS ${NMEA_WORK_DIR}/nmea_parser.su su_lines)
+  nmea_stack(preprocess_nmea deepest)
+  foreach(sentence IN LISTS enabled)
+    string(TOLOWER ${sentence} name)
+    nmea_stack(populate_${name} populate)
+    nmea_stack(clear_${name} clear)
+    math(EXPR chain "${populate} + ${clear}")
+    if(sentence STREQUAL "GSV")
+      nmea_stack(free_gsv_sat free)
+      math(EXPR chain "${chain} + ${free}")
+    elseif(sentence STREQUAL "PUBX03")
+      nmea_stack(free_pubx03_sat free)
+      math(EXPR chain "${chain} + ${free}")
+    endif()
+    if(sentence MATCHES "^PUBX")
+      # PUBX sentences are preprocessed one call deeper
+      nmea_stack(preprocess_nmea preprocess)
+      if(preprocess GREATER chain)
+        set(chain ${preprocess})
+      endif()
+      nmea_stack(nmea_parse_pubx pubx)
+      math(EXPR chain "${chain} + ${pubx}")
+    endif()
+    if(chain GREATER deepest)
+      set(deepest ${chain})
+    endif()
+  endforeach()
+  nmea_stack(nmea_parse parse)
+  math(EXPR stack "${parse} + ${deepest}")
+
+  string(REPLACE ";" "," label "${enabled}")
+  nmea_pad("${label}" ${label_width} FALSE row)
+  foreach(value ${buffer} ${nav} ${structs} ${total})
+    nmea_pad(" ${value}" 7 TRUE cell)
+    string(APPEND row "${cell}")
+  endforeach()
+  nmea_pad(" ${stack}" 17 TRUE cell) # "stack excl. libc"
+  string(APPEND row "${cell}")
+  string(APPEND report "${row}\n")
+endforeach()
+
+file(WRITE ${NMEA_WORK_DIR}/nmea_footprint.txt "${report}")
+message("${report}")
+message("written to ${NMEA_WORK_DIR}/nmea_footprint.txt")
@@ -1,8 +1,10 @@
 #ifdef __cplusplus
+#include <cctype>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #else
+#include <ctype.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -10,38 +12,59 @@
 
 #include "nmea_parser.h"
 
+// In the footprint profile a direction/status bit is set when the parsed
+// character matches `set`, otherwise the character is stored as is.
+#if NMEA_FOOTPRINT
+#define NMEA_STORE_FLAG(c, set) ((c) == (set))
+#else
+#define NMEA_STORE_FLAG(c, set) (c)
+#endif
+
+// Works in place so there is no second sentence sized buffer on the stack.
+// The first pass drops leading zeros (the sentence only shrinks), the second
+// one walks backwards and fills empty fields with '0' (the sentence only grows,
+// anything past the end of the buffer is cut off).
 void preprocess_nmea(nmeaBuffer_t *nmea) {
-  char buffer[NMEA_BUFFER_SIZE];
-  char *src = nmea->str;
-  char *dst = buffer;
-  char *end = buffer + sizeof(buffer) - 1;
+  char *str = nmea->str;
+  char *end = str + sizeof(nmea->str) - 1;
+  char *src = str;
+  char *dst = str;
+  unsigned int empty_fields = 0;
   int leading_zero = 1;
 
-  while (*src && dst < end) {
-    if (*src == ',' && (*(src + 1) == ',' || *(src + 1) == '*')) {
-      *dst++ = ',';
-      *dst++ = '0';
-      leading_zero = 1;
-    } else if (*src == ',') {
-      *dst++ = *src;
+  while (src < end && *src) {
+    if (*src == ',') {
+      if (*(src + 1) == ',' || *(src + 1) == '*') {
+        empty_fields++;
+      }
       leading_zero = 1;
     } else if (*src == '0' && leading_zero) {
       // Skip leading zero
       if (*(src + 1) >= '0' && *(src + 1) <= '9') {
         src++;
         continue;
-      } else {
-        *dst++ = '0';
-        leading_zero = 0;
       }
+      leading_zero = 0;
     } else {
-      *dst++ = *src;
       leading_zero = 0;
     }
-    src++;
+    *dst++ = *src++;
+  }
+
+  src = dst;
+  dst += empty_fields;
+  *(dst < end ? dst : end) = '\0';
+  char next = '\0';
+  while (dst != src) {
+    char c = *--src;
+    if (c == ',' && (next == ',' || next == '*')) {
+      if (--dst < end)
+        *dst = '0';
+    }
+    if (--dst < end)
+      *dst = c;
+    next = c;
   }
-  *dst = '\0';
-  strcpy(nmea->str, buffer);
 }
 
 void nmea_init(navData_t *navData, const char *talker, const char *begin_from) {
@@ -67,8 +90,10 @@ void nmea_init(navData_t *navData, const char *talker, const char *begin_from) {
 #endif
 #if NMEA_GSV_ENABLED
   if (navData->gsv) {
+#if !NMEA_FOOTPRINT
     navData->gsv->sat_info = (xxGSV_sat_t *)malloc(sizeof(xxGSV_sat_t));
     navData->gsv->checksum = (unsigned char *)malloc(sizeof(unsigned short));
+#endif
     navData->cycles_max++;
   }
 #endif
@@ -76,17 +101,50 @@ void nmea_init(navData_t *navData, const char *talker, const char *begin_from) {
   if (navData->gll)
     navData->cycles_max++;
 #endif
+#if NMEA_GNS_ENABLED
+  if (navData->gns)
+    navData->cycles_max++;
+#endif
+#if NMEA_GST_ENABLED
+  if (navData->gst)
+    navData->cycles_max++;
+#endif
+#if NMEA_ZDA_ENABLED
+  if (navData->zda)
+    navData->cycles_max++;
+#endif
+#if NMEA_PUBX00_ENABLED
+  if (navData->pubx00)
+    navData->cycles_max++;
+#endif
+#if NMEA_PUBX03_ENABLED
+  if (navData->pubx03) {
+#if !NMEA_FOOTPRINT
+    navData->pubx03->sat_info = NULL;
+#endif
+    navData->cycles_max++;
+  }
+#endif
+#if NMEA_PUBX04_ENABLED
+  if (navData->pubx04)
+    navData->cycles_max++;
+#endif
 }
 
 #if NMEA_RMC_ENABLED
 void populate_rmc(const char *nmea, xxRMC_t *rmc) {
   clear_rmc(rmc);
   const char *data = nmea + 7;
+  char status = 0, lat_dir = 0, lon_dir = 0, mg_dir = 0;
 
   sscanf(data, "%f,%c,%f,%c,%f,%c,%f,%f,%u,%f,%c,%c*%hhx", &rmc->time,
-         &rmc->status, &rmc->lat, &rmc->lat_dir, &rmc->lon, &rmc->lon_dir,
-         &rmc->speed, &rmc->course, &rmc->date, &rmc->mg_var, &rmc->mg_dir,
-         &rmc->checksum_mode, &rmc->checksum);
+         &status, &rmc->lat, &lat_dir, &rmc->lon, &lon_dir, &rmc->speed,
+         &rmc->course, &rmc->date, &rmc->mg_var, &mg_dir, &rmc->checksum_mode,
+         &rmc->checksum);
+  rmc->status = NMEA_STORE_FLAG(status, 'A');
+  rmc->lat_dir = NMEA_STORE_FLAG(lat_dir, 'S');
+  rmc->lon_dir = NMEA_STORE_FLAG(lon_dir, 'W');
+  rmc->mg_dir = NMEA_STORE_FLAG(mg_dir, 'W');
 }
 
 void clear_rmc(xxRMC_t *rmc) { memset(rmc, 0, sizeof(xxRMC_t)); }
@@ -98,10 +156,13 @@ void populate_gga(char *nmea, xxGGA_t *gga) {
   char *data = nmea + 7;
   char *asterisk_position = strchr(data, '*');
   int characters_read = 0;
+  char lat_dir = 0, lon_dir = 0;
   sscanf(data, "%f,%f,%c,%f,%c,%hhu,%hhu,%f,%f,%c,%f,%c,%n", &gga->time,
-         &gga->lat, &gga->lat_dir, &gga->lon, &gga->lon_dir, &gga->quality,
+         &gga->lat, &lat_dir, &gga->lon, &lon_dir, &gga->quality,
          &gga->sat_count, &gga->hdop, &gga->alt, &gga->unit_alt,
          &gga->geoid_sep, &gga->unit_geoid_sep, &characters_read);
+  gga->lat_dir = NMEA_STORE_FLAG(lat_dir, 'S');
+  gga->lon_dir = NMEA_STORE_FLAG(lon_dir, 'W');
   data += characters_read;
 
   if (asterisk_position != NULL) {
@@ -169,6 +230,7 @@ unsigned int populate_gsv(char *nmea, xxGSV_t *gsv) {
     clear_gsv(gsv);
     sscanf(data, "%hhu,%hhu,%hhu,%n", &gsv->mes_count, &gsv->mes_num,
            &gsv->sat_count, &characters_read);
+#if !NMEA_FOOTPRINT
     gsv->sat_info = (xxGSV_sat_t *)malloc(gsv->sat_count * sizeof(xxGSV_sat_t));
     gsv->checksum =
         (unsigned char *)malloc(gsv->mes_count * sizeof(unsigned short));
@@ -176,7 +238,14 @@ unsigned int populate_gsv(char *nmea, xxGSV_t *gsv) {
       fprintf(stderr, "Memory allocation failed\n");
       exit(EXIT_FAILURE);
     }
+#endif
   }
+#if NMEA_FOOTPRINT
+  // satellites past the storage limit are skipped, mes_count is kept so the
+  // group still completes on its last message only
+  if (gsv->sat_count > NMEA_GSV_MAX_SATS)
+    gsv->sat_count = NMEA_GSV_MAX_SATS;
+#endif
   data += characters_read;
 
   if (asterisk_position != NULL) {
@@ -186,8 +255,11 @@ unsigned int populate_gsv(char *nmea, xxGSV_t *gsv) {
     value_str[2] = '\0';
 
     // Convert the string value to unsigned short
-    gsv->checksum[gsv->mes_num - 1] =
-        (unsigned short)strtoul(value_str, NULL, 16);
+#if NMEA_FOOTPRINT
+    if (gsv->mes_num >= 1 && gsv->mes_num <= NMEA_GSV_MAX_MESSAGES)
+#endif
+      gsv->checksum[gsv->mes_num - 1] =
+          (unsigned short)strtoul(value_str, NULL, 16);
 
     // Replace the asterisk and its value with a comma
     *asterisk_position = ',';
@@ -201,7 +273,12 @@ unsigned int populate_gsv(char *nmea, xxGSV_t *gsv) {
     gsv->sat_iteriation++;
     data += characters_read;
   }
+#if NMEA_FOOTPRINT
+  if (gsv->mes_num == gsv->mes_count &&
+      gsv->sat_iteriation == gsv->sat_count) {
+#else
   if (gsv->sat_iteriation == gsv->sat_count) {
+#endif
     return 1;
   } else {
     return 0;
@@ -209,12 +286,16 @@ unsigned int populate_gsv(char *nmea, xxGSV_t *gsv) {
 }
 
 void free_gsv_sat(xxGSV_t *gsv) {
+#if NMEA_FOOTPRINT
+  (void)gsv; // nothing is allocated
+#else
   if (gsv->sat_info) {
     free(gsv->sat_info);
     gsv->sat_info = NULL;
     free(gsv->checksum);
     gsv->checksum = NULL;
   }
+#endif
 }
 void clear_gsv(xxGSV_t *gsv) {
   free_gsv_sat(gsv);
@@ -226,14 +307,177 @@ void clear_gsv(xxGSV_t *gsv) {
 void populate_gll(const char *nmea, xxGLL_t *gll) {
   clear_gll(gll);
   const char *data = nmea + 7;
-  sscanf(data, "%f,%c,%f,%c,%f,%c,%c*%hhx", &gll->lat, &gll->lat_dir, &gll->lon,
-         &gll->lon_dir, &gll->utc_time, &gll->status, &gll->checksum_mode,
+  char lat_dir = 0, lon_dir = 0, status = 0;
+  sscanf(data, "%f,%c,%f,%c,%f,%c,%c*%hhx", &gll->lat, &lat_dir, &gll->lon,
+         &lon_dir, &gll->utc_time, &status, &gll->checksum_mode,
          &gll->checksum);
+  gll->lat_dir = NMEA_STORE_FLAG(lat_dir, 'S');
+  gll->lon_dir = NMEA_STORE_FLAG(lon_dir, 'W');
+  gll->status = NMEA_STORE_FLAG(status, 'A');
 }
 
 void clear_gll(xxGLL_t *gll) { memset(gll, 0, sizeof(xxGLL_t)); }
 #endif
 
+#if NMEA_GNS_ENABLED
+void populate_gns(const char *nmea, xxGNS_t *gns) {
+  clear_gns(gns);
+  const char *data = nmea + 7;
+  int characters_read = 0;
+  char lat_dir = 0, lon_dir = 0;
+  sscanf(data, "%f,%f,%c,%f,%c,%6[^,],%hhu,%f,%f,%f,%f,%hu%n", &gns->time,
+         &gns->lat, &lat_dir, &gns->lon, &lon_dir, gns->mode, &gns->sat_count,
+         &gns->hdop, &gns->alt, &gns->geoid_sep, &gns->age, &gns->rs_id,
+         &characters_read);
+  gns->lat_dir = NMEA_STORE_FLAG(lat_dir, 'S');
+  gns->lon_dir = NMEA_STORE_FLAG(lon_dir, 'W');
+  data += characters_read;
+
+  // Navigational status is only sent by NMEA 4.1 and newer receivers
+  if (characters_read && *data == ',') {
+    sscanf(data, ",%c*%hhx", &gns->nav_status, &gns->checksum);
+  } else {
+    sscanf(data, "*%hhx", &gns->checksum);
+  }
+}
+
+void clear_gns(xxGNS_t *gns) { memset(gns, 0, sizeof(xxGNS_t)); }
+#endif
+
+#if NMEA_GST_ENABLED
+void populate_gst(const char *nmea, xxGST_t *gst) {
+  clear_gst(gst);
+  const char *data = nmea + 7;
+  sscanf(data, "%f,%f,%f,%f,%f,%f,%f,%f*%hhx", &gst->time, &gst->rms,
+         &gst->std_major, &gst->std_minor, &gst->orient, &gst->std_lat,
+         &gst->std_lon, &gst->std_alt, &gst->checksum);
+}
+
+void clear_gst(xxGST_t *gst) { memset(gst, 0, sizeof(xxGST_t)); }
+#endif
+
+#if NMEA_ZDA_ENABLED
+void populate_zda(const char *nmea, xxZDA_t *zda) {
+  clear_zda(zda);
+  const char *data = nmea + 7;
+  sscanf(data, "%f,%hhu,%hhu,%hu,%hhd,%hhu*%hhx", &zda->time, &zda->day,
+         &zda->month, &zda->year, &zda->zone_hours, &zda->zone_minutes,
+         &zda->checksum);
+}
+
+void clear_zda(xxZDA_t *zda) { memset(zda, 0, sizeof(xxZDA_t)); }
+#endif
+
+#if NMEA_PUBX_ENABLED
+// PUBX sentences carry a message ID instead of a talker ID, and the ID has
+// lost its leading zero by the time the sentence is populated ($PUBX,0,...)
+static const char *pubx_data(const char *nmea) {
+  const char *data = strchr(nmea + 6, ',');
+  return data ? data + 1 : nmea + strlen(nmea);
+}
+#endif
+
+#if NMEA_PUBX00_ENABLED
+void populate_pubx00(const char *nmea, PUBX00_t *pubx00) {
+  clear_pubx00(pubx00);
+  const char *data = pubx_data(nmea);
+  char lat_dir = 0, lon_dir = 0;
+  sscanf(data,
+         "%f,%f,%c,%f,%c,%f,%2[^,],%f,%f,%f,%f,%f,%f,%f,%f,%f,%hhu,%*u,%hhu*"
+         "%hhx",
+         &pubx00->time, &pubx00->lat, &lat_dir, &pubx00->lon, &lon_dir,
+         &pubx00->alt, pubx00->nav_status, &pubx00->h_acc, &pubx00->v_acc,
+         &pubx00->speed, &pubx00->course, &pubx00->v_vel, &pubx00->age,
+         &pubx00->hdop, &pubx00->vdop, &pubx00->tdop, &pubx00->sat_count,
+         &pubx00->dr, &pubx00->checksum);
+  pubx00->lat_dir = NMEA_STORE_FLAG(lat_dir, 'S');
+  pubx00->lon_dir = NMEA_STORE_FLAG(lon_dir, 'W');
+}
+
+void clear_pubx00(PUBX00_t *pubx00) { memset(pubx00, 0, sizeof(PUBX00_t)); }
+#endif
+
+#if NMEA_PUBX03_ENABLED
+void populate_pubx03(const char *nmea, PUBX03_t *pubx03) {
+  clear_pubx03(pubx03);
+  const char *data = pubx_data(nmea);
+  const char *asterisk_position = strchr(data, '*');
+  int characters_read = 0;
+
+  sscanf(data, "%hhu%n", &pubx03->sat_count, &characters_read);
+  data += characters_read;
+#if NMEA_FOOTPRINT
+  if (pubx03->sat_count > NMEA_PUBX03_MAX_SATS)
+    pubx03->sat_count = NMEA_PUBX03_MAX_SATS;
+#else
+  if (pubx03->sat_count) {
+    pubx03->sat_info =
+        (PUBX03_sat_t *)malloc(pubx03->sat_count * sizeof(PUBX03_sat_t));
+    if (!pubx03->sat_info) {
+      fprintf(stderr, "Memory allocation failed\n");
+      exit(EXIT_FAILURE);
+    }
+  }
+#endif
+
+  // A sentence cut short by the buffer keeps only the satellites it holds
+  unsigned char sat_parsed = 0;
+  while (sat_parsed < pubx03->sat_count) {
+    PUBX03_sat_t *sat = &pubx03->sat_info[sat_parsed];
+    characters_read = 0;
+    sscanf(data, ",%hhu,%c,%hu,%hhu,%hhu,%hhu%n", &sat->sat_id, &sat->status,
+           &sat->azimuth, &sat->elevation, &sat->cno, &sat->lock_time,
+           &characters_read);
+    if (!characters_read)
+      break;
+    sat_parsed++;
+    data += characters_read;
+  }
+  pubx03->sat_count = sat_parsed;
+
+  if (asterisk_position != NULL) {
+    sscanf(asterisk_position + 1, "%hhx", &pubx03->checksum);
+  }
+}
+
+void free_pubx03_sat(PUBX03_t *pubx03) {
+#if NMEA_FOOTPRINT
+  (void)pubx03; // nothing is allocated
+#else
+  if (pubx03->sat_info) {
+    free(pubx03->sat_info);
+    pubx03->sat_info = NULL;
+  }
+#endif
+}
+
+void clear_pubx03(PUBX03_t *pubx03) {
+  free_pubx03_sat(pubx03);
+  memset(pubx03, 0, sizeof(PUBX03_t));
+}
+#endif
+
+#if NMEA_PUBX04_ENABLED
+void populate_pubx04(const char *nmea, PUBX04_t *pubx04) {
+  clear_pubx04(pubx04);
+  const char *data = pubx_data(nmea);
+  int characters_read = 0;
+  sscanf(data, "%f,%u,%f,%hu,%hhu%n", &pubx04->time, &pubx04->date,
+         &pubx04->utc_tow, &pubx04->week, &pubx04->leap_sec,
+         &characters_read);
+  data += characters_read;
+
+  if (characters_read && *data == 'D') {
+    pubx04->leap_default = 1;
+    data++;
+  }
+  sscanf(data, ",%ld,%f,%hu,%*u*%hhx", &pubx04->clk_bias, &pubx04->clk_drift,
+         &pubx04->tp_gran, &pubx04->checksum);
+}
+
+void clear_pubx04(PUBX04_t *pubx04) { memset(pubx04, 0, sizeof(PUBX04_t)); }
+#endif
+
 void nmea_free(navData_t *navData) {
 #if NMEA_GSV_ENABLED
   if (navData->gsv)
@@ -259,14 +503,104 @@ void nmea_free(navData_t *navData) {
   if (navData->gll)
     clear_gll(navData->gll);
 #endif
+#if NMEA_GNS_ENABLED
+  if (navData->gns)
+    clear_gns(navData->gns);
+#endif
+#if NMEA_GST_ENABLED
+  if (navData->gst)
+    clear_gst(navData->gst);
+#endif
+#if NMEA_ZDA_ENABLED
+  if (navData->zda)
+    clear_zda(navData->zda);
+#endif
+#if NMEA_PUBX00_ENABLED
+  if (navData->pubx00)
+    clear_pubx00(navData->pubx00);
+#endif
+#if NMEA_PUBX03_ENABLED
+  if (navData->pubx03)
+    clear_pubx03(navData->pubx03);
+#endif
+#if NMEA_PUBX04_ENABLED
+  if (navData->pubx04)
+    clear_pubx04(navData->pubx04);
+#endif
 }
 
 void nmea_nullify(navData_t *navData) { memset(navData, 0, sizeof(navData_t)); }
 
+int nmea_verify(const nmeaBuffer_t *nmea) {
+  const char *c = nmea->str;
+  const char *end = nmea->str + sizeof(nmea->str);
+  unsigned char checksum = 0;
+  if (*c != '$') {
+    return 1;
+  }
+  // XOR of everything between '$' and '*'
+  for (c++; c < end && *c && *c != '*'; c++) {
+    checksum ^= (unsigned char)*c;
+  }
+  if (end - c < 3 || *c != '*' || !isxdigit((unsigned char)c[1]) ||
+      !isxdigit((unsigned char)c[2])) {
+    return 1;
+  }
+  char value_str[3] = {c[1], c[2], '\0'};
+  return (unsigned char)strtoul(value_str, NULL, 16) != checksum;
+}
+
+#if NMEA_PUBX_ENABLED
+// The message ID is matched before preprocess_nmea strips its leading zero
+static int nmea_parse_pubx(nmeaBuffer_t *nmea, navData_t *navData) {
+  const char *id = nmea->str + 6;
+  if (navData->cycle == navData->cycles_max) {
+    navData->cycle = 0;
+  }
+#if NMEA_PUBX00_ENABLED
+  if (strncmp(id, "00,", 3) == 0) {
+    if (navData->pubx00) {
+      preprocess_nmea(nmea);
+      populate_pubx00(nmea->str, navData->pubx00);
+      navData->cycle++;
+    }
+    return 0;
+  }
+#endif
+#if NMEA_PUBX03_ENABLED
+  if (strncmp(id, "03,", 3) == 0) {
+    if (navData->pubx03) {
+      preprocess_nmea(nmea);
+      populate_pubx03(nmea->str, navData->pubx03);
+      navData->cycle++;
+    }
+    return 0;
+  }
+#endif
+#if NMEA_PUBX04_ENABLED
+  if (strncmp(id, "04,", 3) == 0) {
+    if (navData->pubx04) {
+      preprocess_nmea(nmea);
+      populate_pubx04(nmea->str, navData->pubx04);
+      navData->cycle++;
+    }
+    return 0;
+  }
+#endif
+  return 1;
+}
+#endif
+
 int nmea_parse(nmeaBuffer_t *nmea, navData_t *navData) {
   if (strlen(nmea->str) == 0) {
     return 1;
   }
+#if NMEA_PUBX_ENABLED
+  // u-blox proprietary sentences have no talker ID
+  if (strncmp(nmea->str, "$PUBX,", 6) == 0) {
+    return nmea_parse_pubx(nmea, navData);
+  }
+#endif
   if (strncmp(nmea->str + 1, navData->talker, 2)) {
     return 1;
   }
@@ -322,6 +656,30 @@ int nmea_parse(nmeaBuffer_t *nmea, navData_t *navData) {
       navData->cycle++;
     }
   }
+#endif
+#if NMEA_GNS_ENABLED
+  else if (strncmp(nmea_str + 3, "GNS", 3) == 0) {
+    if (navData->gns) {
+      populate_gns(nmea_str, navData->gns);
+      navData->cycle++;
+    }
+  }
+#endif
+#if NMEA_GST_ENABLED
+  else if (strncmp(nmea_str + 3, "GST", 3) == 0) {
+    if (navData->gst) {
+      populate_gst(nmea_str, navData->gst);
+      navData->cycle++;
+    }
+  }
+#endif
+#if NMEA_ZDA_ENABLED
+  else if (strncmp(nmea_str + 3, "ZDA", 3) == 0) {
+    if (navData->zda) {
+      populate_zda(nmea_str, navData->zda);
+      navData->cycle++;
+    }
+  }
 #endif
   else {
     return 1;
@@ -336,16 +694,16 @@ void print_rmc(const navData_t *data) {
   if (data->rmc) {
     printf("RMC\n");
     printf("Time: %f\n", data->rmc->time);
-    printf("Status: %c\n", data->rmc->status);
+    printf("Status: %c\n", NMEA_STATUS_CHAR(data->rmc->status));
     printf("Latitude: %f\n", data->rmc->lat);
-    printf("Latitude Direction: %c\n", data->rmc->lat_dir);
+    printf("Latitude Direction: %c\n", NMEA_LAT_DIR_CHAR(data->rmc->lat_dir));
     printf("Longitude: %f\n", data->rmc->lon);
-    printf("Longitude Direction: %c\n", data->rmc->lon_dir);
+    printf("Longitude Direction: %c\n", NMEA_LON_DIR_CHAR(data->rmc->lon_dir));
     printf("Speed: %f\n", data->rmc->speed);
     printf("Course: %f\n", data->rmc->course);
     printf("Date: %u\n", data->rmc->date);
     printf("Magnetic Variation: %f\n", data->rmc->mg_var);
-    printf("Magnetic Direction: %c\n", data->rmc->mg_dir);
+    printf("Magnetic Direction: %c\n", NMEA_LON_DIR_CHAR(data->rmc->mg_dir));
     printf("Checksum Mode: %c\n", data->rmc->checksum_mode);
     printf("Checksum: %hhx\n", data->rmc->checksum);
   }
@@ -358,9 +716,9 @@ void print_gga(const navData_t *data) {
     printf("GGA\n");
     printf("Time: %f\n", data->gga->time);
     printf("Latitude: %f\n", data->gga->lat);
-    printf("Latitude Direction: %c\n", data->gga->lat_dir);
+    printf("Latitude Direction: %c\n", NMEA_LAT_DIR_CHAR(data->gga->lat_dir));
     printf("Longitude: %f\n", data->gga->lon);
-    printf("Longitude Direction: %c\n", data->gga->lon_dir);
+    printf("Longitude Direction: %c\n", NMEA_LON_DIR_CHAR(data->gga->lon_dir));
     printf("Quality: %hhu\n", data->gga->quality);
     printf("Satellite Count: %hhu\n", data->gga->sat_count);
     printf("HDOP: %f\n", data->gga->hdop);
@@ -425,6 +783,10 @@ void print_gsv(const navData_t *data) {
       printf("SNR: %hhu\n", sat->snr);
     }
     for (int i = 0; i < data->gsv->mes_count; i++) {
+#if NMEA_FOOTPRINT
+      if (i == NMEA_GSV_MAX_MESSAGES)
+        break;
+#endif
       printf("Checksum %d: %hhx\n", i + 1, data->gsv->checksum[i]);
     }
   }
@@ -436,17 +798,137 @@ void print_gll(const navData_t *data) {
   if (data->gll) {
     printf("GLL\n");
     printf("Latitude: %f\n", data->gll->lat);
-    printf("Latitude Direction: %c\n", data->gll->lat_dir);
+    printf("Latitude Direction: %c\n", NMEA_LAT_DIR_CHAR(data->gll->lat_dir));
     printf("Longitude: %f\n", data->gll->lon);
-    printf("Longitude Direction: %c\n", data->gll->lon_dir);
+    printf("Longitude Direction: %c\n", NMEA_LON_DIR_CHAR(data->gll->lon_dir));
     printf("UTC Time: %f\n", data->gll->utc_time);
-    printf("Status: %c\n", data->gll->status);
+    printf("Status: %c\n", NMEA_STATUS_CHAR(data->gll->status));
     printf("Checksum Mode: %c\n", data->gll->checksum_mode);
     printf("Checksum: %hhx\n", data->gll->checksum);
   }
 }
 #endif
 
+#if NMEA_GNS_ENABLED
+void print_gns(const navData_t *data) {
+  if (data->gns) {
+    printf("GNS\n");
+    printf("Time: %f\n", data->gns->time);
+    printf("Latitude: %f\n", data->gns->lat);
+    printf("Latitude Direction: %c\n", NMEA_LAT_DIR_CHAR(data->gns->lat_dir));
+    printf("Longitude: %f\n", data->gns->lon);
+    printf("Longitude Direction: %c\n", NMEA_LON_DIR_CHAR(data->gns->lon_dir));
+    printf("Mode: %s\n", data->gns->mode);
+    printf("Satellite Count: %hhu\n", data->gns->sat_count);
+    printf("HDOP: %f\n", data->gns->hdop);
+    printf("Altitude: %f\n", data->gns->alt);
+    printf("Geoid Separation: %f\n", data->gns->geoid_sep);
+    printf("Age: %f\n", data->gns->age);
+    printf("Reference Station ID: %hu\n", data->gns->rs_id);
+    printf("Navigational Status: %c\n", data->gns->nav_status);
+    printf("Checksum: %hhx\n", data->gns->checksum);
+  }
+}
+#endif
+
+#if NMEA_GST_ENABLED
+void print_gst(const navData_t *data) {
+  if (data->gst) {
+    printf("GST\n");
+    printf("Time: %f\n", data->gst->time);
+    printf("RMS: %f\n", data->gst->rms);
+    printf("Semi-major Deviation: %f\n", data->gst->std_major);
+    printf("Semi-minor Deviation: %f\n", data->gst->std_minor);
+    printf("Orientation: %f\n", data->gst->orient);
+    printf("Latitude Deviation: %f\n", data->gst->std_lat);
+    printf("Longitude Deviation: %f\n", data->gst->std_lon);
+    printf("Altitude Deviation: %f\n", data->gst->std_alt);
+    printf("Checksum: %hhx\n", data->gst->checksum);
+  }
+}
+#endif
+
+#if NMEA_ZDA_ENABLED
+void print_zda(const navData_t *data) {
+  if (data->zda) {
+    printf("ZDA\n");
+    printf("Time: %f\n", data->zda->time);
+    printf("Day: %hhu\n", data->zda->day);
+    printf("Month: %hhu\n", data->zda->month);
+    printf("Year: %hu\n", data->zda->year);
+    printf("Zone Hours: %hhd\n", data->zda->zone_hours);
+    printf("Zone Minutes: %hhu\n", data->zda->zone_minutes);
+    printf("Checksum: %hhx\n", data->zda->checksum);
+  }
+}
+#endif
+
+#if NMEA_PUBX00_ENABLED
+void print_pubx00(const navData_t *data) {
+  if (data->pubx00) {
+    printf("PUBX,00\n");
+    printf("Time: %f\n", data->pubx00->time);
+    printf("Latitude: %f\n", data->pubx00->lat);
+    printf("Latitude Direction: %c\n",
+           NMEA_LAT_DIR_CHAR(data->pubx00->lat_dir));
+    printf("Longitude: %f\n", data->pubx00->lon);
+    printf("Longitude Direction: %c\n",
+           NMEA_LON_DIR_CHAR(data->pubx00->lon_dir));
+    printf("Altitude: %f\n", data->pubx00->alt);
+    printf("Navigation Status: %s\n", data->pubx00->nav_status);
+    printf("Horizontal Accuracy: %f\n", data->pubx00->h_acc);
+    printf("Vertical Accuracy: %f\n", data->pubx00->v_acc);
+    printf("Speed: %f\n", data->pubx00->speed);
+    printf("Course: %f\n", data->pubx00->course);
+    printf("Vertical Velocity: %f\n", data->pubx00->v_vel);
+    printf("Age: %f\n", data->pubx00->age);
+    printf("HDOP: %f\n", data->pubx00->hdop);
+    printf("VDOP: %f\n", data->pubx00->vdop);
+    printf("TDOP: %f\n", data->pubx00->tdop);
+    printf("Satellite Count: %hhu\n", data->pubx00->sat_count);
+    printf("DR: %hhu\n", data->pubx00->dr);
+    printf("Checksum: %hhx\n", data->pubx00->checksum);
+  }
+}
+#endif
+
+#if NMEA_PUBX03_ENABLED
+void print_pubx03(const navData_t *data) {
+  if (data->pubx03) {
+    printf("PUBX,03\n");
+    printf("Satellite Count: %hhu\n", data->pubx03->sat_count);
+    for (int i = 0; i < data->pubx03->sat_count; i++) {
+      const PUBX03_sat_t *sat = &data->pubx03->sat_info[i];
+      printf("Satellite ID: %hhu\n", sat->sat_id);
+      printf("Status: %c\n", sat->status);
+      printf("Azimuth: %hu\n", sat->azimuth);
+      printf("Elevation: %hhu\n", sat->elevation);
+      printf("C/N0: %hhu\n", sat->cno);
+      printf("Lock Time: %hhu\n", sat->lock_time);
+    }
+    printf("Checksum: %hhx\n", data->pubx03->checksum);
+  }
+}
+#endif
+
+#if NMEA_PUBX04_ENABLED
+void print_pubx04(const navData_t *data) {
+  if (data->pubx04) {
+    printf("PUBX,04\n");
+    printf("Time: %f\n", data->pubx04->time);
+    printf("Date: %u\n", data->pubx04->date);
+    printf("UTC Time of Week: %f\n", data->pubx04->utc_tow);
+    printf("UTC Week: %hu\n", data->pubx04->week);
+    printf("Leap Seconds: %hhu%s\n", data->pubx04->leap_sec,
+           data->pubx04->leap_default ? " (default)" : "");
+    printf("Clock Bias: %ld\n", data->pubx04->clk_bias);
+    printf("Clock Drift: %f\n", data->pubx04->clk_drift);
+    printf("Time Pulse Granularity: %hu\n", data->pubx04->tp_gran);
+    printf("Checksum: %hhx\n", data->pubx04->checksum);
+  }
+}
+#endif
+
 void print_nav(const navData_t *data) {
 #if NMEA_RMC_ENABLED
   if (data->rmc) {
@@ -483,6 +965,42 @@ void print_nav(const navData_t *data) {
     printf("###################################\n");
     print_gll(data);
   }
+#endif
+#if NMEA_GNS_ENABLED
+  if (data->gns) {
+    printf("###################################\n");
+    print_gns(data);
+  }
+#endif
+#if NMEA_GST_ENABLED
+  if (data->gst) {
+    printf("###################################\n");
+    print_gst(data);
+  }
+#endif
+#if NMEA_ZDA_ENABLED
+  if (data->zda) {
+    printf("###################################\n");
+    print_zda(data);
+  }
+#endif
+#if NMEA_PUBX00_ENABLED
+  if (data->pubx00) {
+    printf("###################################\n");
+    print_pubx00(data);
+  }
+#endif
+#if NMEA_PUBX03_ENABLED
+  if (data->pubx03) {
+    printf("###################################\n");
+    print_pubx03(data);
+  }
+#endif
+#if NMEA_PUBX04_ENABLED
+  if (data->pubx04) {
+    printf("###################################\n");
+    print_pubx04(data);
+  }
 #endif
   printf("###################################\n");
 }
@@ -27,11 +27,92 @@
 #define NMEA_GLL_ENABLED 1
 #endif
 
+#ifndef NMEA_GNS_ENABLED
+#define NMEA_GNS_ENABLED 1
+#endif
+
+#ifndef NMEA_GST_ENABLED
+#define NMEA_GST_ENABLED 1
+#endif
+
+#ifndef NMEA_ZDA_ENABLED
+#define NMEA_ZDA_ENABLED 1
+#endif
+
+// Footprint profile for small MCUs: sentence sized buffer, no heap in the GSV
+// path and direction/status fields packed into single bits.
+#ifndef NMEA_FOOTPRINT
+#define NMEA_FOOTPRINT 0
+#endif
+
+// u-blox proprietary $PUBX,00 / 03 / 04, opt-in as they need to be enabled on
+// the receiver and do not follow the NMEA 0183 length limit.
+// PUBX,03 takes up to 20 characters per satellite, enabling it raises the
+// default buffer to 512 (24 satellites, 128 with NMEA_FOOTPRINT). Longer
+// sentences do not fit, raise NMEA_BUFFER_SIZE for receivers reporting more.
+#ifndef NMEA_PUBX00_ENABLED
+#define NMEA_PUBX00_ENABLED 0
+#endif
+
+#ifndef NMEA_PUBX03_ENABLED
+#define NMEA_PUBX03_ENABLED 0
+#endif
+
+#ifndef NMEA_PUBX04_ENABLED
+#define NMEA_PUBX04_ENABLED 0
+#endif
+
+#define NMEA_PUBX_ENABLED                                                      \
+  (NMEA_PUBX00_ENABLED || NMEA_PUBX03_ENABLED || NMEA_PUBX04_ENABLED)
+
 #ifndef NMEA_BUFFER_SIZE
+#if NMEA_FOOTPRINT && NMEA_PUBX_ENABLED
+#define NMEA_BUFFER_SIZE 128 // PUBX sentences exceed the NMEA 0183 limit
+#elif NMEA_FOOTPRINT
+#define NMEA_BUFFER_SIZE 83 // NMEA 0183 caps sentences at 82 characters
+#elif NMEA_PUBX03_ENABLED
+#define NMEA_BUFFER_SIZE 512 // PUBX,03 with up to 24 satellites
+#else
 #define NMEA_BUFFER_SIZE 256
 #endif
+#endif
+
+// GSV storage limits, only used with NMEA_FOOTPRINT (4 satellites per message)
+#ifndef NMEA_GSV_MAX_SATS
+#define NMEA_GSV_MAX_SATS 16
+#endif
+
+#ifndef NMEA_GSV_MAX_MESSAGES
+#define NMEA_GSV_MAX_MESSAGES 4
+#endif
+
+// PUBX,03 storage limit, only used with NMEA_FOOTPRINT. As many satellites as
+// the buffer can hold: "$PUBX,03,n" takes 10 characters and a satellite at
+// least 12 once empty fields are filled and leading zeros stripped
+// (",2,-,0,0,0,0").
+#ifndef NMEA_PUBX03_MAX_SATS
+#define NMEA_PUBX03_MAX_SATS ((NMEA_BUFFER_SIZE - 11) / 12)
+#endif
+
+// Direction and status fields. In the footprint profile they are one bit wide
+// and hold 1 for the character given to NMEA_FLAG_CHAR as `set`, use the
+// NMEA_*_CHAR macros to read them the same way in both profiles.
+#if NMEA_FOOTPRINT
+#define NMEA_FLAG(name) unsigned char name : 1
+#define NMEA_FLAG_CHAR(flag, set, unset) ((flag) ? (set) : (unset))
+#else
+#define NMEA_FLAG(name) char name
+#define NMEA_FLAG_CHAR(flag, set, unset) (flag)
+#endif
+#define NMEA_LAT_DIR_CHAR(flag) NMEA_FLAG_CHAR(flag, 'S', 'N')
+#define NMEA_LON_DIR_CHAR(flag) NMEA_FLAG_CHAR(flag, 'W', 'E')
+#define NMEA_STATUS_CHAR(flag) NMEA_FLAG_CHAR(flag, 'A', 'V')
+
+// The sentence structs below list their fields widest first (floats, shorts,
+// chars, then the flags) in both profiles, so no padding is wasted and the
+// one bit flags share a byte. The numbered comments keep the field order of
+// the sentence, initialize the structs by name and not by position.
 
-#endif // NMEA_PARSER_H
 typedef struct {
   char str[NMEA_BUFFER_SIZE];
 } nmeaBuffer_t;
@@ -39,58 +120,58 @@ typedef struct {
 typedef struct {
   // $--RMC,hhmmss.ss,A,llll.ll,a,yyyyy.yy,a,x.x,x.x,xxxx,x.x,a*hh
   float time;             // 1) Time (UTC)
-  char status;            // 2) Status, V = Navigation receiver warning
   float lat;              // 3) Latitude
-  char lat_dir;           // 4) N or S
   float lon;              // 5) Longitude
-  char lon_dir;           // 6) E or W
   float speed;            // 7) Speed over ground, knots
   float course;           // 8) Track made good, degrees true
   unsigned int date;      // 9) Date, ddmmyy
   float mg_var;           // 10) Magnetic Variation, degrees
-  char mg_dir;            // 11) E or W
   char checksum_mode;     // 12) Mode indicator
   unsigned char checksum; // 13) Checksum
+  NMEA_FLAG(status);      // 2) Status, V = Navigation receiver warning
+  NMEA_FLAG(lat_dir);     // 4) N or S
+  NMEA_FLAG(lon_dir);     // 6) E or W
+  NMEA_FLAG(mg_dir);      // 11) E or W
 } xxRMC_t;
 
 typedef struct {
 
   // $--GGA,hhmmss.ss,llll.ll,a,yyyyy.yy,a,x,xx,x.x,x.x,M,x.x,M,x.x,xxxx*hh
-  float time;            // 1) Time (UTC)
-  float lat;             // 2) Latitude
-  char lat_dir;          // 3) N or S (North or South)
-  float lon;             // 4) Longitude
-  char lon_dir;          // 5) E or W (East or West)
-  unsigned char quality; // 6) GPS Quality Indicator,
-  // 0 - fix not available,
-  // 1 - GPS fix,
-  // 2 - Differential GPS fix
-  unsigned char sat_count; // 7) Number of satellites in view, 00 - 12
-  float hdop;              // 8) Horizontal Dilution of precision
+  float time;      // 1) Time (UTC)
+  float lat;       // 2) Latitude
+  float lon;       // 4) Longitude
+  float hdop;      // 8) Horizontal Dilution of precision
   float alt;       // 9) Antenna Altitude above/below mean-sea-level (geoid)
-  char unit_alt;   // 10) Units of antenna altitude, meters
   float geoid_sep; // 11) Geoidal separation, the difference between the WGS-84
                    // earth
   // ellipsoid and mean-sea-level (geoid), "-" means mean-sea-level below
   // ellipsoid
-  char unit_geoid_sep; // 12) Units of geoidal separation, meters
   float
       age; // 13) Age of differential GPS data, time in seconds since last SC104
   // type 1 or 9 update, null field when DGPS is not used
-  unsigned short rs_id;   // 14) Differential reference station ID, 0000-1023
-  unsigned char checksum; // 15) Checksum
+  unsigned short rs_id;  // 14) Differential reference station ID, 0000-1023
+  unsigned char quality; // 6) GPS Quality Indicator,
+  // 0 - fix not available,
+  // 1 - GPS fix,
+  // 2 - Differential GPS fix
+  unsigned char sat_count; // 7) Number of satellites in view, 00 - 12
+  char unit_alt;           // 10) Units of antenna altitude, meters
+  char unit_geoid_sep;     // 12) Units of geoidal separation, meters
+  unsigned char checksum;  // 15) Checksum
+  NMEA_FLAG(lat_dir);      // 3) N or S (North or South)
+  NMEA_FLAG(lon_dir);      // 5) E or W (East or West)
 
 } xxGGA_t;
 
 typedef struct {
   // $--VTG,x.x,T,x.x,M,x.x,N,x.x,K*hh
   float degrees;          // 1) Track Degrees
-  char state;             // 2) T = True
   float degrees2;         // 3) Track Degrees
-  char magnetic_sign;     // 4) M = Magnetic
   float speed_knots;      // 5) Speed Knots
-  char knots;             // 6) N = Knots
   float speed_kmh;        // 7) Speed Kilometers Per Hour
+  char state;             // 2) T = True
+  char magnetic_sign;     // 4) M = Magnetic
+  char knots;             // 6) N = Knots
   char kmh;               // 8) K = Kilometres Per Hour
   char checksum_mode;     // 	Mode indicator:
                           // A: Autonomous mode
@@ -105,15 +186,15 @@ typedef struct {
 typedef struct {
 
   // $--GSA,a,a,x,x,x,x,x,x,x,x,x,x,x,x,x,x,x.x,x.x,x.x*hh
+  float pdop;    // 15) PDOP in meters
+  float hdop;    // 16) HDOP in meters
+  float vdop;    // 17) VDOP in meters
   char sel_mode; // 1) Selection mode
   char mode;     // 2) Mode
   // 3) ID of 1st satellite used for fix
   // 4) ID of 2nd satellite used for fix
   unsigned char sat_id[12]; // ...
   // 14) ID of 12th satellite used for fix
-  float pdop;             // 15) PDOP in meters
-  float hdop;             // 16) HDOP in meters
-  float vdop;             // 17) VDOP in meters
   unsigned char checksum; // 18) Checksum
 
 } xxGSA_t;
@@ -131,11 +212,16 @@ typedef struct {
   unsigned char mes_count; // 1) total number of messages
   unsigned char mes_num;   // none // 2) message number
   unsigned char sat_count; // 3) satellites in view
-  xxGSV_sat_t *sat_info;   // 4) satellite infos
-  unsigned char *checksum; // 8) Checksum
-  //
   unsigned char sat_iteriation; // determine how many satellites are parsed
+#if NMEA_FOOTPRINT
+  // fixed storage, sat_count is clamped to NMEA_GSV_MAX_SATS
+  xxGSV_sat_t sat_info[NMEA_GSV_MAX_SATS];       // 4) satellite infos
+  unsigned char checksum[NMEA_GSV_MAX_MESSAGES]; // 8) Checksum
+#else
   // to be held as heap
+  xxGSV_sat_t *sat_info;   // 4) satellite infos
+  unsigned char *checksum; // 8) Checksum
+#endif
 } xxGSV_t;
 
 typedef struct {
@@ -143,15 +229,137 @@ typedef struct {
   // Geographic Position – Latitude/Longitude
   // $--GLL,llll.ll,a,yyyyy.yy,a,hhmmss.ss,A*hh
   float lat;              // 1) Latitude
-  char lat_dir;           // 2) N or S (North or South)
   float lon;              // 3) Longitude
-  char lon_dir;           // 4) E or W (East or West)
   float utc_time;         // 5) Time (UTC)
-  char status;            // 6) Status A - Data Valid, V - Data Invalid
   char checksum_mode;     // 7) Mode indicator
   unsigned char checksum; // 7) Checksum
+  NMEA_FLAG(lat_dir);     // 2) N or S (North or South)
+  NMEA_FLAG(lon_dir);     // 4) E or W (East or West)
+  NMEA_FLAG(status);      // 6) Status A - Data Valid, V - Data Invalid
 } xxGLL_t;
 
+typedef struct {
+  // GNS
+  // GNSS Fix Data
+  // $--GNS,hhmmss.ss,llll.ll,a,yyyyy.yy,a,c--c,xx,x.x,x.x,x.x,x.x,x.x,a*hh
+  float time;              // 1) Time (UTC)
+  float lat;               // 2) Latitude
+  float lon;               // 4) Longitude
+  float hdop;              // 8) Horizontal Dilution of precision
+  float alt;               // 9) Orthometric height (MSL), meters
+  float geoid_sep;         // 10) Geoidal separation, meters
+  float age;               // 11) Age of differential data, seconds
+  unsigned short rs_id;    // 12) Differential reference station ID
+  char mode[7];            // 6) Mode indicator, one character per system
+                           // (GPS, GLONASS, Galileo, BeiDou, QZSS, NavIC)
+  unsigned char sat_count; // 7) Number of satellites in use
+  char nav_status;         // 13) Navigational status (NMEA 4.1+), 0 if absent
+  unsigned char checksum;  // 14) Checksum
+  NMEA_FLAG(lat_dir);      // 3) N or S (North or South)
+  NMEA_FLAG(lon_dir);      // 5) E or W (East or West)
+} xxGNS_t;
+
+typedef struct {
+  // GST
+  // GNSS Pseudorange Error Statistics
+  // $--GST,hhmmss.ss,x.x,x.x,x.x,x.x,x.x,x.x,x.x*hh
+  float time;             // 1) Time (UTC)
+  float rms;              // 2) RMS of the standard deviation of the ranges
+  float std_major;        // 3) Standard deviation of semi-major axis, meters
+  float std_minor;        // 4) Standard deviation of semi-minor axis, meters
+  float orient;           // 5) Orientation of semi-major axis, degrees true
+  float std_lat;          // 6) Standard deviation of latitude error, meters
+  float std_lon;          // 7) Standard deviation of longitude error, meters
+  float std_alt;          // 8) Standard deviation of altitude error, meters
+  unsigned char checksum; // 9) Checksum
+} xxGST_t;
+
+typedef struct {
+  // ZDA
+  // Time & Date
+  // $--ZDA,hhmmss.ss,xx,xx,xxxx,xx,xx*hh
+  float time;                 // 1) Time (UTC)
+  unsigned short year;        // 4) Year
+  unsigned char day;          // 2) Day, 01 to 31
+  unsigned char month;        // 3) Month, 01 to 12
+  signed char zone_hours;     // 5) Local zone hours, -13 to 13
+  unsigned char zone_minutes; // 6) Local zone minutes, 00 to 59
+  unsigned char checksum;     // 7) Checksum
+} xxZDA_t;
+
+typedef struct {
+  // PUBX,00
+  // u-blox Lat/Long Position Data
+  // $PUBX,00,hhmmss.ss,llll.ll,a,yyyyy.yy,a,x.x,cc,x.x,x.x,x.x,x.x,x.x,x.x,
+  //   x.x,x.x,x.x,x,x,x*hh
+  float time;              // 1) Time (UTC)
+  float lat;               // 2) Latitude
+  float lon;               // 4) Longitude
+  float alt;               // 6) Altitude above user datum ellipsoid, meters
+  float h_acc;             // 8) Horizontal accuracy estimate, meters
+  float v_acc;             // 9) Vertical accuracy estimate, meters
+  float speed;             // 10) Speed over ground, km/h
+  float course;            // 11) Course over ground, degrees
+  float v_vel;             // 12) Vertical velocity, m/s, positive downwards
+  float age;               // 13) Age of differential corrections, seconds
+  float hdop;              // 14) Horizontal Dilution of precision
+  float vdop;              // 15) Vertical Dilution of precision
+  float tdop;              // 16) Time Dilution of precision
+  unsigned char sat_count; // 17) Number of satellites used
+                           // 18) Reserved
+  unsigned char dr;        // 19) DR used
+  char nav_status[3];      // 7) Navigation status
+  // NF - No Fix, DR - Dead reckoning only,
+  // G2/G3 - Stand alone 2D/3D, D2/D3 - Differential 2D/3D,
+  // RK - GPS + dead reckoning, TT - Time only
+  unsigned char checksum; // 20) Checksum
+  NMEA_FLAG(lat_dir);     // 3) N or S (North or South)
+  NMEA_FLAG(lon_dir);     // 5) E or W (East or West)
+} PUBX00_t;
+
+typedef struct {
+  unsigned short azimuth;  // 3) azimuth in degrees
+  unsigned char sat_id;    // 1) satellite ID
+  unsigned char elevation; // 4) elevation in degrees
+  unsigned char cno;       // 5) signal strength C/N0, dBHz
+  unsigned char lock_time; // 6) satellite carrier lock time, seconds
+  char status;             // 2) U - used, e - ephemeris but not used,
+                           // - - not used
+  // more satellite infos like 1)-6)
+} PUBX03_sat_t;
+
+typedef struct {
+  // PUBX,03
+  // u-blox Satellite Status
+  // $PUBX,03,xx,{xx,a,xxx,xx,xx,xx,}*hh
+  unsigned char sat_count; // 1) Number of satellites tracked
+  unsigned char checksum;  // 8) Checksum
+#if NMEA_FOOTPRINT
+  // fixed storage, sat_count is clamped to this limit
+  PUBX03_sat_t sat_info[NMEA_PUBX03_MAX_SATS]; // 2) satellite infos
+#else
+  // to be held as heap
+  PUBX03_sat_t *sat_info; // 2) satellite infos
+#endif
+} PUBX03_t;
+
+typedef struct {
+  // PUBX,04
+  // u-blox Time of Day and Clock Information
+  // $PUBX,04,hhmmss.ss,ddmmyy,x.x,x,xxD,x,x.x,x,*hh
+  long clk_bias;              // 6) Receiver clock bias, ns
+  float time;                 // 1) Time (UTC)
+  unsigned int date;          // 2) Date, ddmmyy
+  float utc_tow;              // 3) UTC time of week, seconds
+  float clk_drift;            // 7) Receiver clock drift, ns/s
+  unsigned short week;        // 4) UTC week number
+  unsigned short tp_gran;     // 8) Time pulse granularity, ns
+  unsigned char leap_sec;     // 5) Leap seconds
+  unsigned char leap_default; // 5) 1 if leap seconds is the firmware default
+                              // ('D' suffix)
+  unsigned char checksum;     // 9) Checksum
+} PUBX04_t;
+
 typedef struct {
   char talker[3];     // Navigation system e.g. GPS - GP, GLONASS - GL, etc.
   char begin_from[4]; // Start parsing from this NMEA sentence
@@ -175,8 +383,30 @@ typedef struct {
 #if NMEA_GLL_ENABLED
   xxGLL_t *gll;
 #endif
+#if NMEA_GNS_ENABLED
+  xxGNS_t *gns;
+#endif
+#if NMEA_GST_ENABLED
+  xxGST_t *gst;
+#endif
+#if NMEA_ZDA_ENABLED
+  xxZDA_t *zda;
+#endif
+#if NMEA_PUBX00_ENABLED
+  PUBX00_t *pubx00;
+#endif
+#if NMEA_PUBX03_ENABLED
+  PUBX03_t *pubx03;
+#endif
+#if NMEA_PUBX04_ENABLED
+  PUBX04_t *pubx04;
+#endif
 } navData_t;
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 // do it right after creating the navData_t eg. nmea_set_talker(&navData, "GP");
 void nmea_init(navData_t *navData, const char *talker, const char *begin_from);
 // parsing functions
@@ -209,7 +439,34 @@ void free_gsv_sat(xxGSV_t *gsv);
 void populate_gll(const char *nmea, xxGLL_t *gll);
 void clear_gll(xxGLL_t *gll);
 #endif
+#if NMEA_GNS_ENABLED
+void populate_gns(const char *nmea, xxGNS_t *gns);
+void clear_gns(xxGNS_t *gns);
+#endif
+#if NMEA_GST_ENABLED
+void populate_gst(const char *nmea, xxGST_t *gst);
+void clear_gst(xxGST_t *gst);
+#endif
+#if NMEA_ZDA_ENABLED
+void populate_zda(const char *nmea, xxZDA_t *zda);
+void clear_zda(xxZDA_t *zda);
+#endif
+#if NMEA_PUBX00_ENABLED
+void populate_pubx00(const char *nmea, PUBX00_t *pubx00);
+void clear_pubx00(PUBX00_t *pubx00);
+#endif
+#if NMEA_PUBX03_ENABLED
+void populate_pubx03(const char *nmea, PUBX03_t *pubx03);
+void clear_pubx03(PUBX03_t *pubx03);
+void free_pubx03_sat(PUBX03_t *pubx03);
+#endif
+#if NMEA_PUBX04_ENABLED
+void populate_pubx04(const char *nmea, PUBX04_t *pubx04);
+void clear_pubx04(PUBX04_t *pubx04);
+#endif
 void preprocess_nmea(nmeaBuffer_t *nmea);
+// 0 if the checksum after '*' matches the raw sentence, call before nmea_parse
+int nmea_verify(const nmeaBuffer_t *nmea);
 #ifdef NMEA_PRINT
 #if NMEA_RMC_ENABLED
 void print_rmc(const navData_t *data);
@@ -229,5 +486,29 @@ void print_vtg(const navData_t *data);
 #if NMEA_GLL_ENABLED
 void print_gll(const navData_t *data);
 #endif
+#if NMEA_GNS_ENABLED
+void print_gns(const navData_t *data);
+#endif
+#if NMEA_GST_ENABLED
+void print_gst(const navData_t *data);
+#endif
+#if NMEA_ZDA_ENABLED
+void print_zda(const navData_t *data);
+#endif
+#if NMEA_PUBX00_ENABLED
+void print_pubx00(const navData_t *data);
+#endif
+#if NMEA_PUBX03_ENABLED
+void print_pubx03(const navData_t *data);
+#endif
+#if NMEA_PUBX04_ENABLED
+void print_pubx04(const navData_t *data);
+#endif
 void print_nav(const navData_t *data);
 #endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NMEA_PARSER_H